@@ -23,16 +23,16 @@ AMREX_GPU_MANAGED amrex::Real helmholtz::ttol;
 AMREX_GPU_MANAGED amrex::Real helmholtz::dtol;
 
 // for the helmholtz free energy tables
-AMREX_GPU_MANAGED amrex::Real helmholtz::f[jmax][imax][9];
+AMREX_GPU_MANAGED amrex::Real (*helmholtz::f)[imax][9];
 
 // for the pressure derivative with density tables
-AMREX_GPU_MANAGED amrex::Real helmholtz::dpdf[jmax][imax][4];
+AMREX_GPU_MANAGED amrex::Real (*helmholtz::dpdf)[imax][4];
 
 // for chemical potential tables
-AMREX_GPU_MANAGED amrex::Real helmholtz::ef[jmax][imax][4];
+AMREX_GPU_MANAGED amrex::Real (*helmholtz::ef)[imax][4];
 
 // for the number density tables
-AMREX_GPU_MANAGED amrex::Real helmholtz::xf[jmax][imax][4];
+AMREX_GPU_MANAGED amrex::Real (*helmholtz::xf)[imax][4];
 
 // for storing the differences
 AMREX_GPU_MANAGED amrex::Real helmholtz::dt_sav[jmax];
@@ -44,3 +44,16 @@ AMREX_GPU_MANAGED amrex::Real helmholtz::dd_sav[imax];
 AMREX_GPU_MANAGED amrex::Real helmholtz::dd2_sav[imax];
 AMREX_GPU_MANAGED amrex::Real helmholtz::ddi_sav[imax];
 AMREX_GPU_MANAGED amrex::Real helmholtz::dd2i_sav[imax];
+
+// for the inverse tables
+AMREX_GPU_MANAGED bool helmholtz::use_inverse_tables;
+
+AMREX_GPU_MANAGED amrex::Real helmholtz::inv_abar;
+AMREX_GPU_MANAGED amrex::Real helmholtz::inv_zbar;
+
+AMREX_GPU_MANAGED amrex::Real helmholtz::inv_dxi;
+
+AMREX_GPU_MANAGED amrex::Real helmholtz::inv_shift[inv_nvars][inv_nx];
+AMREX_GPU_MANAGED amrex::Real helmholtz::inv_ylo[inv_nvars][inv_nx];
+AMREX_GPU_MANAGED amrex::Real helmholtz::inv_dyi[inv_nvars][inv_nx];
+AMREX_GPU_MANAGED amrex::Real helmholtz::inv_logT[inv_nvars][inv_nx][inv_ny];
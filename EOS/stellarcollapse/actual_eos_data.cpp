@@ -0,0 +1,23 @@
+#include <actual_eos_data.H>
+
+AMREX_GPU_MANAGED int stellarcollapse::nrho;
+AMREX_GPU_MANAGED int stellarcollapse::ntemp;
+AMREX_GPU_MANAGED int stellarcollapse::nye;
+
+AMREX_GPU_MANAGED amrex::Real stellarcollapse::logrho_lo;
+AMREX_GPU_MANAGED amrex::Real stellarcollapse::logrho_hi;
+AMREX_GPU_MANAGED amrex::Real stellarcollapse::dlogrho_inv;
+
+AMREX_GPU_MANAGED amrex::Real stellarcollapse::logtemp_lo;
+AMREX_GPU_MANAGED amrex::Real stellarcollapse::logtemp_hi;
+AMREX_GPU_MANAGED amrex::Real stellarcollapse::dlogtemp_inv;
+
+AMREX_GPU_MANAGED amrex::Real stellarcollapse::ye_lo;
+AMREX_GPU_MANAGED amrex::Real stellarcollapse::ye_hi;
+AMREX_GPU_MANAGED amrex::Real stellarcollapse::dye_inv;
+
+AMREX_GPU_MANAGED amrex::Real stellarcollapse::energy_shift;
+AMREX_GPU_MANAGED amrex::Real stellarcollapse::temp_conv;
+
+AMREX_GPU_MANAGED amrex::Real* stellarcollapse::thermo;
+AMREX_GPU_MANAGED amrex::Real* stellarcollapse::aux;
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+
+# Convert a stellarcollapse.org HDF5 EOS table into the flat binary
+# format that the C++ stellarcollapse EOS can read without HDF5 (and
+# faster than the HDF5 file).
+#
+# The file is
+#
+#   "SCEOSBIN"                       8 bytes
+#   nrho, ntemp, nye, nthermo, naux  int32
+#   energy_shift                     float64
+#   logrho, logtemp, ye              float64 grids
+#   thermo                           float64 [nye][ntemp][nrho][nthermo]
+#   aux                              float64 [nye][ntemp][nrho][naux]
+#
+# all little-endian, with the variables interleaved at each point, in
+# the order of sc_thermo_t and sc_aux_t in actual_eos_data.H.
+#
+# usage: convert_stellarcollapse_table.py table.h5 table.bin
+
+import argparse
+import struct
+
+import h5py
+import numpy as np
+
+# these must match actual_eos_data.H
+
+thermo_names = ["logpress", "logenergy", "entropy", "cs2",
+                "dedt", "dpdrhoe", "dpderho", "gamma"]
+
+aux_names = ["munu", "muhat", "mu_e", "mu_p", "mu_n",
+             "Xa", "Xh", "Xn", "Xp", "Abar", "Zbar"]
+
+
+def write_interleaved(f, h5, names, nye):
+    """write the datasets names, interleaved, one Y_e plane at a time"""
+
+    for k in range(nye):
+        plane = np.stack([np.asarray(h5[name][k, :, :], dtype="<f8") for name in names],
+                         axis=-1)
+        f.write(plane.tobytes())
+
+
+def convert(infile, outfile):
+
+    with h5py.File(infile, "r") as h5:
+
+        nrho = int(np.asarray(h5["pointsrho"]).flat[0])
+        ntemp = int(np.asarray(h5["pointstemp"]).flat[0])
+        nye = int(np.asarray(h5["pointsye"]).flat[0])
+
+        energy_shift = float(np.asarray(h5["energy_shift"]).flat[0])
+
+        with open(outfile, "wb") as f:
+            f.write(b"SCEOSBIN")
+            f.write(struct.pack("<5i", nrho, ntemp, nye, len(thermo_names), len(aux_names)))
+            f.write(struct.pack("<d", energy_shift))
+
+            for grid in ["logrho", "logtemp", "ye"]:
+                f.write(np.asarray(h5[grid], dtype="<f8").tobytes())
+
+            write_interleaved(f, h5, thermo_names, nye)
+            write_interleaved(f, h5, aux_names, nye)
+
+    print(f"wrote {outfile}: {nrho} x {ntemp} x {nye} (rho, T, Y_e)")
+
+
+if __name__ == "__main__":
+
+    p = argparse.ArgumentParser()
+    p.add_argument("infile", type=str, help="stellarcollapse.org HDF5 table")
+    p.add_argument("outfile", type=str, help="output binary table")
+
+    args = p.parse_args()
+
+    convert(args.infile, args.outfile)
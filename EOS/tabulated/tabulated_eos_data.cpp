@@ -0,0 +1,27 @@
+#include <tabulated_eos_data.H>
+
+AMREX_GPU_MANAGED bool eos_table::use_table;
+AMREX_GPU_MANAGED bool eos_table::use_inverse_tables;
+
+AMREX_GPU_MANAGED int eos_table::nrho;
+AMREX_GPU_MANAGED int eos_table::ntemp;
+
+AMREX_GPU_MANAGED amrex::Real eos_table::xlo;
+AMREX_GPU_MANAGED amrex::Real eos_table::xhi;
+AMREX_GPU_MANAGED amrex::Real eos_table::dx;
+AMREX_GPU_MANAGED amrex::Real eos_table::dxi;
+
+AMREX_GPU_MANAGED amrex::Real eos_table::ylo;
+AMREX_GPU_MANAGED amrex::Real eos_table::yhi;
+AMREX_GPU_MANAGED amrex::Real eos_table::dy;
+AMREX_GPU_MANAGED amrex::Real eos_table::dyi;
+
+AMREX_GPU_MANAGED amrex::Real eos_table::table_X[NumSpec];
+AMREX_GPU_MANAGED amrex::Real eos_table::X_tol;
+
+AMREX_GPU_MANAGED amrex::Real eos_table::tab[eos_table::max_ntemp][eos_table::max_nrho][eos_table::tab_nvars][4];
+AMREX_GPU_MANAGED amrex::Real eos_table::aux[eos_table::max_ntemp][eos_table::max_nrho][eos_table::tab_naux];
+
+AMREX_GPU_MANAGED amrex::Real eos_table::inv_lo[eos_table::inv_nvars][eos_table::max_nrho];
+AMREX_GPU_MANAGED amrex::Real eos_table::inv_dli[eos_table::inv_nvars][eos_table::max_nrho];
+AMREX_GPU_MANAGED amrex::Real eos_table::inv_y[eos_table::inv_nvars][eos_table::max_nrho][eos_table::inv_n];
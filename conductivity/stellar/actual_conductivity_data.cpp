@@ -0,0 +1,7 @@
+#include <actual_conductivity_data.H>
+
+AMREX_GPU_MANAGED bool stellar_cond_table::initialized = false;
+
+AMREX_GPU_MANAGED amrex::Real stellar_cond_table::max_rel_error;
+
+AMREX_GPU_MANAGED amrex::Real stellar_cond_table::log_cond[nzbar][nye][ntemp][nrho];
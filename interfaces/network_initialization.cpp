@@ -1,3 +1,10 @@
+#include <table_registry.H>
+
+#if defined(REACTIONS) && defined(NETWORK_SOLVER) && (INTEGRATOR == 0)
+#include <AMReX.H>
+#include <extern_parameters.H>
+#endif
+
 #ifdef REACTIONS
 #ifdef NETWORK_HAS_CXX_IMPLEMENTATION
 #include <actual_network.H>
@@ -13,4 +20,18 @@ void network_init()
     actual_rhs_init();
 #endif
 #endif
+
+#if defined(REACTIONS) && defined(NETWORK_SOLVER) && (INTEGRATOR == 0)
+    // VODE only has these for the dense linear algebra
+
+    if (use_mixed_precision_lu) {
+        amrex::Error("use_mixed_precision_lu is not supported with USE_NETWORK_SOLVER = TRUE");
+    }
+
+    if (vode_reduce_network) {
+        amrex::Error("vode_reduce_network is not supported with USE_NETWORK_SOLVER = TRUE");
+    }
+#endif
+
+    table_registry::report();
 }
@@ -0,0 +1,251 @@
+#include <algorithm>
+#include <vector>
+
+#include <AMReX_Arena.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_Print.H>
+
+#include <table_registry.H>
+
+#if defined(AMREX_USE_MPI) && !defined(AMREX_USE_GPU)
+#define TABLE_REGISTRY_SHARED
+#include <mpi.h>
+#endif
+
+namespace table_registry
+{
+    namespace
+    {
+        struct table_t
+        {
+            std::string name;
+            std::size_t nbytes;
+            void* ptr;
+            bool reported;
+#ifdef TABLE_REGISTRY_SHARED
+            MPI_Win win;
+#endif
+        };
+
+        std::vector<table_t> tables;
+
+        bool finalize_registered = false;
+
+        // the most we send in one broadcast, to keep the counts in an int
+        const std::size_t bcast_chunk = std::size_t(1) << 30;
+
+#ifdef TABLE_REGISTRY_SHARED
+        // the ranks on this node, and the first rank on each node
+        MPI_Comm node_comm = MPI_COMM_NULL;
+        MPI_Comm leader_comm = MPI_COMM_NULL;
+
+        int node_rank = 0;
+        int node_size = 1;
+
+        // the rank in leader_comm of the node with the I/O processor
+        int io_leader = 0;
+
+        void setup_comms ()
+        {
+            if (node_comm != MPI_COMM_NULL) {
+                return;
+            }
+
+            const MPI_Comm comm = amrex::ParallelDescriptor::Communicator();
+            const int rank = amrex::ParallelDescriptor::MyProc();
+
+            MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &node_comm);
+            MPI_Comm_rank(node_comm, &node_rank);
+            MPI_Comm_size(node_comm, &node_size);
+
+            MPI_Comm_split(comm, node_rank == 0 ? 0 : MPI_UNDEFINED, rank, &leader_comm);
+
+            int io_node = amrex::ParallelDescriptor::IOProcessor() ? 1 : 0;
+            MPI_Allreduce(MPI_IN_PLACE, &io_node, 1, MPI_INT, MPI_MAX, node_comm);
+
+            if (leader_comm != MPI_COMM_NULL) {
+                int leader_rank;
+                MPI_Comm_rank(leader_comm, &leader_rank);
+                io_leader = io_node ? leader_rank : 0;
+                MPI_Allreduce(MPI_IN_PLACE, &io_leader, 1, MPI_INT, MPI_MAX, leader_comm);
+            }
+        }
+
+        void free_comms ()
+        {
+            if (leader_comm != MPI_COMM_NULL) {
+                MPI_Comm_free(&leader_comm);
+            }
+            if (node_comm != MPI_COMM_NULL) {
+                MPI_Comm_free(&node_comm);
+            }
+            node_rank = 0;
+            node_size = 1;
+            io_leader = 0;
+        }
+#endif
+
+        std::vector<table_t>::iterator find (const void* ptr)
+        {
+            auto it = std::find_if(tables.begin(), tables.end(),
+                                   [=] (const table_t& t) { return t.ptr == ptr; });
+            if (it == tables.end()) {
+                amrex::Error("table_registry: not a registered table");
+            }
+            return it;
+        }
+
+        std::size_t total_bytes ()
+        {
+            std::size_t n = 0;
+            for (const auto& t : tables) {
+                n += t.nbytes;
+            }
+            return n;
+        }
+
+        amrex::Real megabytes (const std::size_t n)
+        {
+            return static_cast<amrex::Real>(n) / (1024.0_rt * 1024.0_rt);
+        }
+    }
+
+    void* allocate_bytes (const std::string& name, const std::size_t nbytes)
+    {
+        if (!finalize_registered) {
+            amrex::ExecOnFinalize(finalize);
+            finalize_registered = true;
+        }
+
+        for (const auto& t : tables) {
+            if (t.name == name) {
+                release(t.ptr);
+                break;
+            }
+        }
+
+        table_t t;
+        t.name = name;
+        t.nbytes = nbytes;
+        t.ptr = nullptr;
+        t.reported = false;
+
+#ifdef TABLE_REGISTRY_SHARED
+        setup_comms();
+
+        // the first rank on the node owns the memory, and the others
+        // find where it is mapped in their address space
+
+        const MPI_Aint size = node_rank == 0 ? static_cast<MPI_Aint>(nbytes) : 0;
+        MPI_Win_allocate_shared(size, 1, MPI_INFO_NULL, node_comm, &t.ptr, &t.win);
+
+        if (node_rank != 0) {
+            MPI_Aint owner_size;
+            int disp_unit;
+            MPI_Win_shared_query(t.win, 0, &owner_size, &disp_unit, &t.ptr);
+        }
+#else
+        t.ptr = amrex::The_Managed_Arena()->alloc(nbytes);
+#endif
+
+        tables.push_back(t);
+
+        return t.ptr;
+    }
+
+    void share_bytes (const void* ptr)
+    {
+        const auto it = find(ptr);
+
+        char* data = static_cast<char*>(it->ptr);
+
+#ifdef TABLE_REGISTRY_SHARED
+        // the fences make the writes of the I/O processor, and then
+        // those of the broadcast, visible to the whole node
+
+        MPI_Win_fence(0, it->win);
+
+        if (leader_comm != MPI_COMM_NULL) {
+            for (std::size_t lo = 0; lo < it->nbytes; lo += bcast_chunk) {
+                const int n = static_cast<int>(std::min(bcast_chunk, it->nbytes - lo));
+                MPI_Bcast(data + lo, n, MPI_BYTE, io_leader, leader_comm);
+            }
+        }
+
+        MPI_Win_fence(0, it->win);
+#else
+        for (std::size_t lo = 0; lo < it->nbytes; lo += bcast_chunk) {
+            const std::size_t n = std::min(bcast_chunk, it->nbytes - lo);
+            amrex::ParallelDescriptor::Bcast(data + lo, n,
+                                             amrex::ParallelDescriptor::IOProcessorNumber());
+        }
+#endif
+    }
+
+    bool filler ()
+    {
+        return amrex::ParallelDescriptor::IOProcessor();
+    }
+
+    void release (const void* ptr)
+    {
+        // finalize may have freed it already
+
+        auto it = std::find_if(tables.begin(), tables.end(),
+                               [=] (const table_t& t) { return t.ptr == ptr; });
+        if (it == tables.end()) {
+            return;
+        }
+
+#ifdef TABLE_REGISTRY_SHARED
+        MPI_Win_free(&it->win);
+#else
+        amrex::The_Managed_Arena()->free(it->ptr);
+#endif
+
+        tables.erase(it);
+    }
+
+    void finalize ()
+    {
+        while (!tables.empty()) {
+            release(tables.back().ptr);
+        }
+
+#ifdef TABLE_REGISTRY_SHARED
+        free_comms();
+#endif
+
+        finalize_registered = false;
+    }
+
+    void report ()
+    {
+        // only the tables set up since the last report, so that eos_init
+        // and network_init each list their own
+
+        const bool any_new = std::any_of(tables.begin(), tables.end(),
+                                         [] (const table_t& t) { return !t.reported; });
+        if (!any_new) {
+            return;
+        }
+
+        for (auto& t : tables) {
+            if (!t.reported) {
+                amrex::Print() << "microphysics table " << t.name << ": "
+                               << megabytes(t.nbytes) << " MB" << std::endl;
+                t.reported = true;
+            }
+        }
+
+        amrex::Print() << "microphysics tables: " << tables.size() << " tables, "
+                       << megabytes(total_bytes()) << " MB";
+#ifdef TABLE_REGISTRY_SHARED
+        amrex::Print() << " per node, shared by its " << node_size << " ranks ("
+                       << megabytes(total_bytes()) / node_size << " MB per rank)";
+#else
+        amrex::Print() << " per rank";
+#endif
+        amrex::Print() << std::endl;
+    }
+}
@@ -0,0 +1,66 @@
+#include <AMReX_Vector.H>
+#include <actual_network.H>
+
+namespace ECSN
+{
+    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, NumSpec> bion;
+    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, NumSpec> mion;
+}
+
+namespace Rates
+{
+    amrex::Vector<std::string> names;
+}
+
+void actual_network_init()
+{
+    using namespace Species;
+    using namespace ECSN;
+
+    // binding energies per nucleon (MeV)
+    Array1D<Real, 1, NumSpec> ebind_per_nucleon;
+
+    ebind_per_nucleon(H1)   = 0.00000000000000e+00_rt;
+    ebind_per_nucleon(He4)  = 7.07391500000000e+00_rt;
+    ebind_per_nucleon(O16)  = 7.97620600000000e+00_rt;
+    ebind_per_nucleon(O20)  = 7.56857000000000e+00_rt;
+    ebind_per_nucleon(F20)  = 7.72013400000000e+00_rt;
+    ebind_per_nucleon(Ne20) = 8.03224000000000e+00_rt;
+    ebind_per_nucleon(Mg24) = 8.26070900000000e+00_rt;
+    ebind_per_nucleon(Al27) = 8.33155300000000e+00_rt;
+    ebind_per_nucleon(Si28) = 8.44774400000000e+00_rt;
+    ebind_per_nucleon(P31)  = 8.48116700000000e+00_rt;
+    ebind_per_nucleon(S32)  = 8.49312900000000e+00_rt;
+
+    for (int i = 1; i <= NumSpec; ++i) {
+        bion(i) = ebind_per_nucleon(i) * aion[i-1] * C::Legacy::MeV2erg;
+
+        mion(i) = (aion[i-1] - zion[i-1]) * C::Legacy::m_n +
+                  zion[i-1] * (C::Legacy::m_p + C::Legacy::m_e) -
+                  bion(i) / (C::Legacy::c_light * C::Legacy::c_light);
+    }
+
+    // set the names of the reaction rates
+    {
+        using namespace Rates;
+        names.resize(NumRates);
+        names[k_ne20__he4_o16-1]     = "ne20__he4_o16";
+        names[k_he4_o16__ne20-1]     = "he4_o16__ne20";
+        names[k_he4_ne20__mg24-1]    = "he4_ne20__mg24";
+        names[k_he4_mg24__si28-1]    = "he4_mg24__si28";
+        names[k_p_al27__si28-1]      = "p_al27__si28";
+        names[k_he4_al27__p31-1]     = "he4_al27__p31";
+        names[k_he4_si28__s32-1]     = "he4_si28__s32";
+        names[k_p_p31__s32-1]        = "p_p31__s32";
+        names[k_o16_o16__p_p31-1]    = "o16_o16__p_p31";
+        names[k_o16_o16__he4_si28-1] = "o16_o16__he4_si28";
+        names[k_he4_mg24__p_al27-1]  = "he4_mg24__p_al27";
+        names[k_p_al27__he4_mg24-1]  = "p_al27__he4_mg24";
+        names[k_he4_si28__p_p31-1]   = "he4_si28__p_p31";
+        names[k_p_p31__he4_si28-1]   = "p_p31__he4_si28";
+        names[k_f20__o20-1]          = "f20__o20";
+        names[k_ne20__f20-1]         = "ne20__f20";
+        names[k_o20__f20-1]          = "o20__f20";
+        names[k_f20__ne20-1]         = "f20__ne20";
+    }
+}
@@ -0,0 +1,12 @@
+#include <actual_rhs.H>
+
+void actual_rhs_init()
+{
+    screening_init();
+
+    set_up_screening_factors();
+
+    reaclib_init();
+
+    table_rates_init();
+}
@@ -14,15 +14,15 @@ namespace aprox19
 namespace table
 {
 
-  AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> ttlog;
-  AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> ddlog;
-  AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> yetab;
+  AMREX_GPU_MANAGED SharedArray1D<amrex::Real, 1, npts> ttlog;
+  AMREX_GPU_MANAGED SharedArray1D<amrex::Real, 1, npts> ddlog;
+  AMREX_GPU_MANAGED SharedArray1D<amrex::Real, 1, npts> yetab;
 
-  AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> abartab;
-  AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> ebtab;
-  AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, npts> wratetab;
+  AMREX_GPU_MANAGED SharedArray1D<amrex::Real, 1, npts> abartab;
+  AMREX_GPU_MANAGED SharedArray1D<amrex::Real, 1, npts> ebtab;
+  AMREX_GPU_MANAGED SharedArray1D<amrex::Real, 1, npts> wratetab;
 
-  AMREX_GPU_MANAGED amrex::Array2D<amrex::Real, 1, NumSpec, 1, npts> massfractab;
+  AMREX_GPU_MANAGED SharedArray2D<amrex::Real, 1, NumSpec, 1, npts> massfractab;
 
 }
 #endif
@@ -2,9 +2,9 @@
 
 namespace RateTable
 {
-    AMREX_GPU_MANAGED Array2D<Real, 1, Rates::NumRates, 1, nrattab> rattab;
-    AMREX_GPU_MANAGED Array2D<Real, 1, Rates::NumRates, 1, nrattab> drattabdt;
-    AMREX_GPU_MANAGED Array1D<Real, 1, nrattab> ttab;
+    AMREX_GPU_MANAGED SharedArray2D<Real, 1, Rates::NumRates, 1, nrattab> rattab;
+    AMREX_GPU_MANAGED SharedArray2D<Real, 1, Rates::NumRates, 1, nrattab> drattabdt;
+    AMREX_GPU_MANAGED SharedArray1D<Real, 1, nrattab> ttab;
 }
 
 void actual_rhs_init()
@@ -18,6 +18,19 @@ void actual_rhs_init()
     if (use_tables)
     {
         amrex::Print() << "\nInitializing iso7 rate table\n";
-        set_iso7rat();
+
+        // only one rank computes the table, for the ranks to share
+
+        RateTable::rattab.allocate("iso7 rattab");
+        RateTable::drattabdt.allocate("iso7 drattabdt");
+        RateTable::ttab.allocate("iso7 ttab");
+
+        if (table_registry::filler()) {
+            set_iso7rat();
+        }
+
+        table_registry::share(RateTable::rattab.data);
+        table_registry::share(RateTable::drattabdt.data);
+        table_registry::share(RateTable::ttab.data);
     }
 }
@@ -0,0 +1,9 @@
+#include <reaclib_rates.H>
+
+namespace reaclib
+{
+    alignas(64) AMREX_GPU_MANAGED Real coeff[7][num_sets_padded];
+
+    AMREX_GPU_MANAGED int rate_start[Rates::NumReaclibRates];
+    AMREX_GPU_MANAGED int rate_nsets[Rates::NumReaclibRates];
+}
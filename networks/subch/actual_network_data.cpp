@@ -0,0 +1,56 @@
+#include <AMReX_Vector.H>
+#include <actual_network.H>
+
+namespace subch
+{
+    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, NumSpec> bion;
+    AMREX_GPU_MANAGED amrex::Array1D<amrex::Real, 1, NumSpec> mion;
+}
+
+namespace Rates
+{
+    amrex::Vector<std::string> names;
+}
+
+void actual_network_init()
+{
+    using namespace Species;
+    using namespace subch;
+
+    // binding energies per nucleon (MeV)
+    Array1D<Real, 1, NumSpec> ebind_per_nucleon;
+
+    ebind_per_nucleon(H1)   = 0.00000000000000e+00_rt;
+    ebind_per_nucleon(He4)  = 7.07391500000000e+00_rt;
+    ebind_per_nucleon(C12)  = 7.68014400000000e+00_rt;
+    ebind_per_nucleon(C14)  = 7.52031900000000e+00_rt;
+    ebind_per_nucleon(N13)  = 7.23886300000000e+00_rt;
+    ebind_per_nucleon(N14)  = 7.47561400000000e+00_rt;
+    ebind_per_nucleon(O16)  = 7.97620600000000e+00_rt;
+    ebind_per_nucleon(O18)  = 7.76709700000000e+00_rt;
+    ebind_per_nucleon(F18)  = 7.63163800000000e+00_rt;
+    ebind_per_nucleon(Ne20) = 8.03224000000000e+00_rt;
+    ebind_per_nucleon(Ne21) = 7.97171300000000e+00_rt;
+
+    for (int i = 1; i <= NumSpec; ++i) {
+        bion(i) = ebind_per_nucleon(i) * aion[i-1] * C::Legacy::MeV2erg;
+
+        mion(i) = (aion[i-1] - zion[i-1]) * C::Legacy::m_n +
+                  zion[i-1] * (C::Legacy::m_p + C::Legacy::m_e) -
+                  bion(i) / (C::Legacy::c_light * C::Legacy::c_light);
+    }
+
+    // set the names of the reaction rates
+    {
+        using namespace Rates;
+        names.resize(NumRates);
+        names[k_he4_he4_he4__c12-1] = "he4_he4_he4__c12";
+        names[k_he4_c12__o16-1]     = "he4_c12__o16";
+        names[k_he4_n14__f18-1]     = "he4_n14__f18";
+        names[k_he4_f18__p_ne21-1]  = "he4_f18__p_ne21";
+        names[k_p_c12__n13-1]       = "p_c12__n13";
+        names[k_he4_n13__p_o16-1]   = "he4_n13__p_o16";
+        names[k_he4_o16__ne20-1]    = "he4_o16__ne20";
+        names[k_he4_c14__o18-1]     = "he4_c14__o18";
+    }
+}
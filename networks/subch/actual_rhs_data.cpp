@@ -0,0 +1,10 @@
+#include <actual_rhs.H>
+
+void actual_rhs_init()
+{
+    screening_init();
+
+    set_up_screening_factors();
+
+    reaclib_init();
+}
@@ -0,0 +1,12 @@
+#include <table_rates.H>
+
+namespace table_rates
+{
+    AMREX_GPU_MANAGED Real arena[arena_size];
+
+    AMREX_GPU_MANAGED int grid_kind[Rates::NumTabularRates][2];
+    AMREX_GPU_MANAGED Real grid_lo[Rates::NumTabularRates][2];
+    AMREX_GPU_MANAGED Real grid_dinv[Rates::NumTabularRates][2];
+
+    AMREX_GPU_MANAGED bool shared_grids;
+}
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+
+"""Call the C++ EOS and burner on a grid of states with the batched
+interface.  Build the extension first (make) and run this from this
+directory (with helm_table.dat here if using the Helmholtz EOS)."""
+
+import time
+
+import numpy as np
+
+import starkiller_cxx as sk
+
+sk.initialize("probin")
+
+names = sk.species_names()
+
+# a grid of density and temperature, half carbon and half oxygen
+
+rho, T = np.meshgrid(np.logspace(6, 9, 200), np.logspace(8, 9.5, 200))
+rho = rho.ravel().copy()
+T = T.ravel().copy()
+nzones = rho.size
+
+xn = np.zeros((sk.NumSpec, nzones))
+xn[names.index("C12"), :] = 0.5
+xn[names.index("O16"), :] = 0.5
+
+# EOS: the outputs are written into these arrays in place
+
+state = {"rho": rho, "T": T, "xn": xn,
+         "p": np.zeros(nzones), "e": np.zeros(nzones), "cs": np.zeros(nzones)}
+
+start = time.time()
+sk.eos("rt", state)
+print("EOS on {} zones: {:.3f} s".format(nzones, time.time() - start))
+
+# recover T from e, starting from a perturbed guess
+
+T_orig = T.copy()
+state["T"] *= 1.1
+sk.eos("re", state)
+print("max relative error in T from (rho, e): {:.3e}".format(
+    np.max(np.abs(state["T"] - T_orig) / T_orig)))
+
+# burn every zone for 1.e-6 s
+
+burn_state = {"rho": rho, "T": T.copy(), "xn": xn.copy(),
+              "e": np.zeros(nzones),
+              "success": np.zeros(nzones, dtype=np.int32),
+              "n_rhs": np.zeros(nzones, dtype=np.int32)}
+
+start = time.time()
+sk.burn(burn_state, 1.e-6)
+print("burn on {} zones: {:.3f} s".format(nzones, time.time() - start))
+print("failed burns: {}".format(np.sum(burn_state["success"] == 0)))
+print("RHS evaluations: median {}, max {}".format(
+    int(np.median(burn_state["n_rhs"])), np.max(burn_state["n_rhs"])))
@@ -0,0 +1,551 @@
+// A Python extension over the C++ EOS and burner that works on whole
+// arrays of zones at once.
+//
+// The state is passed as a dict of NumPy arrays (or anything else
+// that exports the buffer protocol), one array per quantity, so the
+// data is structure-of-arrays. We read and write the arrays in place
+// through their buffers, so nothing is copied, and the loop over
+// zones releases the GIL and is parallelized with OpenMP.
+//
+//   import starkiller_cxx as sk
+//   sk.initialize("probin")
+//   state = {"rho": rho, "T": T, "xn": xn, "p": p, "e": e}
+//   sk.eos("rt", state)
+//
+// Each 1-d array has one entry per zone. The mass fractions, xn (and
+// aux, for networks that have it), are 2-d, indexed [species, zone].
+// Reals must be float64 and the burn counters int32; any strides are
+// fine.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <AMReX.H>
+
+#include <extern_parameters.H>
+#include <eos.H>
+#include <network.H>
+#include <burner.H>
+
+#include <starkiller_cxx_F.H>
+
+namespace {
+
+bool initialized = false;
+
+// A view of an array exported through the buffer protocol. We hold
+// the buffer for the duration of a call.
+
+class array_view_t
+{
+public:
+
+    array_view_t () = default;
+    array_view_t (const array_view_t&) = delete;
+    array_view_t& operator= (const array_view_t&) = delete;
+
+    ~array_view_t ()
+    {
+        if (m_have_buffer) {
+            PyBuffer_Release(&m_buffer);
+        }
+    }
+
+    // Get the buffer of obj, checking that it holds elements of the
+    // given type ('d' for double, 'i' for int32) and has ndim
+    // dimensions. Sets a Python exception and returns false on error.
+
+    bool acquire (PyObject* obj, const std::string& name, const char type, const int ndim,
+                  const bool writable = true)
+    {
+        if (PyObject_GetBuffer(obj, &m_buffer, writable ? PyBUF_RECORDS : PyBUF_RECORDS_RO) != 0) {
+            PyErr_Format(PyExc_TypeError, "%s must be a%s array", name.c_str(),
+                         writable ? " writable" : "n");
+            return false;
+        }
+        m_have_buffer = true;
+
+        const std::size_t itemsize = type == 'd' ? sizeof(double) : sizeof(std::int32_t);
+        const char* format = m_buffer.format;
+        const std::size_t len = std::strlen(format);
+
+        // accept native and explicitly little/big endian formats
+        // with the right item type and size
+        if (len == 0 || format[len - 1] != type ||
+            static_cast<std::size_t>(m_buffer.itemsize) != itemsize) {
+            PyErr_Format(PyExc_TypeError, "%s must be an array of %s", name.c_str(),
+                         type == 'd' ? "float64" : "int32");
+            return false;
+        }
+
+        if (m_buffer.ndim != ndim) {
+            PyErr_Format(PyExc_ValueError, "%s must be %d-dimensional", name.c_str(), ndim);
+            return false;
+        }
+
+        return true;
+    }
+
+    Py_ssize_t shape (const int dim) const { return m_buffer.shape[dim]; }
+
+    template <typename T>
+    T& at (const Py_ssize_t i) const
+    {
+        return *reinterpret_cast<T*>(static_cast<char*>(m_buffer.buf) + i * m_buffer.strides[0]);
+    }
+
+    template <typename T>
+    T& at (const Py_ssize_t n, const Py_ssize_t i) const
+    {
+        return *reinterpret_cast<T*>(static_cast<char*>(m_buffer.buf) +
+                                     n * m_buffer.strides[0] + i * m_buffer.strides[1]);
+    }
+
+private:
+
+    Py_buffer m_buffer;
+    bool m_have_buffer = false;
+};
+
+// The arrays for a call, looked up by name in the state dict. The
+// zone count is taken from the first array and all others must match.
+
+class state_arrays_t
+{
+public:
+
+    explicit state_arrays_t (PyObject* state) : m_state(state) {}
+
+    // Get an array if it is in the state. Returns nullptr if it is
+    // not (without an exception) or if it is invalid (with one).
+
+    array_view_t* get (const std::string& name, const char type, const int ndim, const Py_ssize_t ncomp = 0)
+    {
+        PyObject* obj = PyDict_GetItemString(m_state, name.c_str());
+        if (obj == nullptr) {
+            return nullptr;
+        }
+
+        m_views.emplace_back(new array_view_t());
+        array_view_t* view = m_views.back().get();
+
+        if (!view->acquire(obj, name, type, ndim)) {
+            m_error = true;
+            return nullptr;
+        }
+
+        if (ndim == 2 && view->shape(0) != ncomp) {
+            PyErr_Format(PyExc_ValueError, "%s must have %zd rows", name.c_str(), ncomp);
+            m_error = true;
+            return nullptr;
+        }
+
+        const Py_ssize_t nzones = view->shape(ndim - 1);
+        if (m_nzones < 0) {
+            m_nzones = nzones;
+        } else if (nzones != m_nzones) {
+            PyErr_Format(PyExc_ValueError, "%s has %zd zones, expected %zd",
+                         name.c_str(), nzones, m_nzones);
+            m_error = true;
+            return nullptr;
+        }
+
+        return view;
+    }
+
+    // Get an array that must be in the state.
+
+    array_view_t* require (const std::string& name, const char type, const int ndim, const Py_ssize_t ncomp = 0)
+    {
+        array_view_t* view = get(name, type, ndim, ncomp);
+        if (view == nullptr && !m_error) {
+            PyErr_Format(PyExc_KeyError, "state must have %s", name.c_str());
+            m_error = true;
+        }
+        return view;
+    }
+
+    bool error () const { return m_error; }
+
+    Py_ssize_t nzones () const { return m_nzones < 0 ? 0 : m_nzones; }
+
+private:
+
+    PyObject* m_state;
+    std::vector<std::unique_ptr<array_view_t>> m_views;
+    Py_ssize_t m_nzones = -1;
+    bool m_error = false;
+};
+
+// The eos_t quantities that can appear in the state.
+
+struct eos_field_t
+{
+    const char* name;
+    amrex::Real eos_t::* member;
+};
+
+const eos_field_t eos_fields[] = {
+    {"p", &eos_t::p}, {"e", &eos_t::e}, {"h", &eos_t::h}, {"s", &eos_t::s},
+    {"dpdT", &eos_t::dpdT}, {"dpdr", &eos_t::dpdr},
+    {"dedT", &eos_t::dedT}, {"dedr", &eos_t::dedr},
+    {"dhdT", &eos_t::dhdT}, {"dhdr", &eos_t::dhdr},
+    {"dsdT", &eos_t::dsdT}, {"dsdr", &eos_t::dsdr},
+    {"dpde", &eos_t::dpde}, {"dpdr_e", &eos_t::dpdr_e},
+    {"cv", &eos_t::cv}, {"cp", &eos_t::cp},
+    {"xne", &eos_t::xne}, {"xnp", &eos_t::xnp}, {"eta", &eos_t::eta},
+    {"pele", &eos_t::pele}, {"ppos", &eos_t::ppos},
+    {"mu", &eos_t::mu}, {"mu_e", &eos_t::mu_e}, {"y_e", &eos_t::y_e},
+    {"gam1", &eos_t::gam1}, {"cs", &eos_t::cs},
+    {"abar", &eos_t::abar}, {"zbar", &eos_t::zbar}
+};
+
+const int num_eos_fields = sizeof(eos_fields) / sizeof(eos_fields[0]);
+
+bool eos_mode (const std::string& name, eos_input_t& mode)
+{
+    const char* names[] = {"rt", "rh", "tp", "rp", "re", "ps", "ph", "th"};
+    const eos_input_t modes[] = {eos_input_rt, eos_input_rh, eos_input_tp, eos_input_rp,
+                                 eos_input_re, eos_input_ps, eos_input_ph, eos_input_th};
+
+    for (int n = 0; n < 8; ++n) {
+        if (name == names[n]) {
+            mode = modes[n];
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool check_initialized ()
+{
+    if (!initialized) {
+        PyErr_SetString(PyExc_RuntimeError, "call initialize() first");
+        return false;
+    }
+    return true;
+}
+
+void finalize ()
+{
+    if (initialized) {
+        amrex::Finalize();
+        initialized = false;
+    }
+}
+
+PyObject* py_initialize (PyObject* /*self*/, PyObject* args)
+{
+    const char* probin = "probin";
+
+    if (!PyArg_ParseTuple(args, "|s", &probin)) {
+        return nullptr;
+    }
+
+    if (initialized) {
+        Py_RETURN_NONE;
+    }
+
+    int argc = 1;
+    char name[] = "starkiller_cxx";
+    char* argv_data[] = {name, nullptr};
+    char** argv = argv_data;
+
+    amrex::Initialize(argc, argv, false);
+
+    // The runtime parameters are read by the Fortran probin reader
+    // and copied to C++.
+
+    std::string probin_file(probin);
+    const int probin_file_length = probin_file.length();
+    std::vector<int> probin_file_name(probin_file_length);
+
+    for (int i = 0; i < probin_file_length; i++) {
+        probin_file_name[i] = probin_file[i];
+    }
+
+    starkiller_cxx_init(probin_file_name.data(), &probin_file_length);
+
+    init_extern_parameters();
+
+    eos_init(small_temp, small_dens);
+
+    network_init();
+
+    initialized = true;
+
+    Py_AtExit(finalize);
+
+    Py_RETURN_NONE;
+}
+
+PyObject* py_species_names (PyObject* /*self*/, PyObject* /*args*/)
+{
+    PyObject* names = PyList_New(NumSpec);
+    for (int n = 0; n < NumSpec; ++n) {
+        PyList_SET_ITEM(names, n, PyUnicode_FromString(short_spec_names_cxx[n].c_str()));
+    }
+    return names;
+}
+
+PyObject* py_eos (PyObject* /*self*/, PyObject* args)
+{
+    const char* mode_name;
+    PyObject* state;
+
+    if (!PyArg_ParseTuple(args, "sO!", &mode_name, &PyDict_Type, &state)) {
+        return nullptr;
+    }
+
+    if (!check_initialized()) {
+        return nullptr;
+    }
+
+    eos_input_t mode;
+    if (!eos_mode(mode_name, mode)) {
+        PyErr_Format(PyExc_ValueError, "unknown EOS input mode %s", mode_name);
+        return nullptr;
+    }
+
+    state_arrays_t arrays(state);
+
+    array_view_t* rho = arrays.require("rho", 'd', 1);
+    array_view_t* T = arrays.require("T", 'd', 1);
+    array_view_t* xn = arrays.require("xn", 'd', 2, NumSpec);
+#if NAUX_NET > 0
+    array_view_t* aux = arrays.get("aux", 'd', 2, NumAux);
+#endif
+
+    std::vector<std::pair<amrex::Real eos_t::*, array_view_t*>> fields;
+    for (int f = 0; f < num_eos_fields; ++f) {
+        array_view_t* view = arrays.get(eos_fields[f].name, 'd', 1);
+        if (view != nullptr) {
+            fields.emplace_back(eos_fields[f].member, view);
+        }
+    }
+
+    if (arrays.error()) {
+        return nullptr;
+    }
+
+    const Py_ssize_t nzones = arrays.nzones();
+
+    // Every quantity in the state is read before the call (so it can
+    // be an input or an initial guess) and overwritten after it.
+
+    Py_BEGIN_ALLOW_THREADS
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (Py_ssize_t i = 0; i < nzones; ++i) {
+
+        eos_t eos_state;
+
+        eos_state.rho = rho->at<double>(i);
+        eos_state.T = T->at<double>(i);
+        for (int n = 0; n < NumSpec; ++n) {
+            eos_state.xn[n] = xn->at<double>(n, i);
+        }
+#if NAUX_NET > 0
+        for (int n = 0; n < NumAux; ++n) {
+            eos_state.aux[n] = aux != nullptr ? aux->at<double>(n, i) : 0.0_rt;
+        }
+#endif
+        for (const auto& f : fields) {
+            eos_state.*(f.first) = f.second->at<double>(i);
+        }
+
+        eos(mode, eos_state);
+
+        rho->at<double>(i) = eos_state.rho;
+        T->at<double>(i) = eos_state.T;
+        for (const auto& f : fields) {
+            f.second->at<double>(i) = eos_state.*(f.first);
+        }
+    }
+
+    Py_END_ALLOW_THREADS
+
+    Py_RETURN_NONE;
+}
+
+PyObject* py_burn (PyObject* /*self*/, PyObject* args)
+{
+    PyObject* state;
+    PyObject* dt_obj;
+
+    if (!PyArg_ParseTuple(args, "O!O", &PyDict_Type, &state, &dt_obj)) {
+        return nullptr;
+    }
+
+    if (!check_initialized()) {
+        return nullptr;
+    }
+
+    state_arrays_t arrays(state);
+
+    array_view_t* rho = arrays.require("rho", 'd', 1);
+    array_view_t* T = arrays.require("T", 'd', 1);
+    array_view_t* xn = arrays.require("xn", 'd', 2, NumSpec);
+#if NAUX_NET > 0
+    array_view_t* aux = arrays.get("aux", 'd', 2, NumAux);
+#endif
+
+    // outputs: the energy release and the integrator diagnostics
+
+    array_view_t* e = arrays.get("e", 'd', 1);
+
+    const char* counter_names[] = {"success", "n_rhs", "n_jac", "n_lu", "n_step",
+                                   "n_step_rejected", "order", "error_code"};
+    const int num_counters = sizeof(counter_names) / sizeof(counter_names[0]);
+
+    array_view_t* counters[num_counters];
+    for (int c = 0; c < num_counters; ++c) {
+        counters[c] = arrays.get(counter_names[c], 'i', 1);
+    }
+
+    // dt is either a number or an array with one entry per zone
+
+    double dt_value = 0.0;
+    array_view_t dt_view;
+    bool dt_is_array = false;
+
+    if (PyFloat_Check(dt_obj) || !PyObject_CheckBuffer(dt_obj)) {
+        dt_value = PyFloat_AsDouble(dt_obj);
+        if (PyErr_Occurred()) {
+            return nullptr;
+        }
+    } else {
+        if (!dt_view.acquire(dt_obj, "dt", 'd', 1, false)) {
+            return nullptr;
+        }
+        dt_is_array = true;
+    }
+
+    if (arrays.error()) {
+        return nullptr;
+    }
+
+    const Py_ssize_t nzones = arrays.nzones();
+
+    if (dt_is_array && dt_view.shape(0) != nzones) {
+        PyErr_Format(PyExc_ValueError, "dt has %zd zones, expected %zd", dt_view.shape(0), nzones);
+        return nullptr;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (Py_ssize_t i = 0; i < nzones; ++i) {
+
+        burn_t burn_state;
+
+        burn_state.rho = rho->at<double>(i);
+        burn_state.T = T->at<double>(i);
+        for (int n = 0; n < NumSpec; ++n) {
+            burn_state.xn[n] = xn->at<double>(n, i);
+        }
+#if NAUX_NET > 0
+        for (int n = 0; n < NumAux; ++n) {
+            burn_state.aux[n] = aux != nullptr ? aux->at<double>(n, i) : 0.0_rt;
+        }
+#endif
+
+        // the integrator does not care about the initial energy,
+        // so e will be the energy released
+        burn_state.e = 0.0_rt;
+
+        const double dt = dt_is_array ? dt_view.at<double>(i) : dt_value;
+
+        burner(burn_state, dt);
+
+        T->at<double>(i) = burn_state.T;
+        for (int n = 0; n < NumSpec; ++n) {
+            xn->at<double>(n, i) = burn_state.xn[n];
+        }
+#if NAUX_NET > 0
+        if (aux != nullptr) {
+            for (int n = 0; n < NumAux; ++n) {
+                aux->at<double>(n, i) = burn_state.aux[n];
+            }
+        }
+#endif
+        if (e != nullptr) {
+            e->at<double>(i) = burn_state.e;
+        }
+
+        const int values[] = {burn_state.success ? 1 : 0, burn_state.n_rhs, burn_state.n_jac,
+                              burn_state.n_lu, burn_state.n_step, burn_state.n_step_rejected,
+                              burn_state.order, burn_state.error_code};
+        for (int c = 0; c < num_counters; ++c) {
+            if (counters[c] != nullptr) {
+                counters[c]->at<std::int32_t>(i) = values[c];
+            }
+        }
+    }
+
+    Py_END_ALLOW_THREADS
+
+    Py_RETURN_NONE;
+}
+
+PyMethodDef methods[] = {
+    {"initialize", py_initialize, METH_VARARGS,
+     "initialize(probin='probin')\n\n"
+     "Read the runtime parameters from probin and initialize the EOS and network."},
+    {"species_names", py_species_names, METH_NOARGS,
+     "species_names()\n\nThe short names of the species, in the order of the rows of xn."},
+    {"eos", py_eos, METH_VARARGS,
+     "eos(mode, state)\n\n"
+     "Call the EOS on every zone, with mode one of rt, rh, tp, rp, re, ps, ph, th.\n"
+     "state is a dict of arrays: rho, T, and xn[NumSpec, nzones] are required, and\n"
+     "any of p, e, h, s, dpdT, dpdr, dedT, dedr, dhdT, dhdr, dsdT, dsdr, dpde,\n"
+     "dpdr_e, cv, cp, xne, xnp, eta, pele, ppos, mu, mu_e, y_e, gam1, cs, abar,\n"
+     "and zbar may be given. All of them are used as inputs (or initial guesses)\n"
+     "and overwritten, in place, with the result."},
+    {"burn", py_burn, METH_VARARGS,
+     "burn(state, dt)\n\n"
+     "Burn every zone for dt (a number or an array). state is a dict of arrays:\n"
+     "rho, T, and xn[NumSpec, nzones] are required, and T and xn are updated in\n"
+     "place. If given, e (float64) gets the energy released, and success, n_rhs,\n"
+     "n_jac, n_lu, n_step, n_step_rejected, order, and error_code (int32) get\n"
+     "the integrator diagnostics."},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+PyModuleDef module = {
+    PyModuleDef_HEAD_INIT,
+    "starkiller_cxx",
+    "Batched calls to the C++ Microphysics EOS and burner on NumPy arrays.",
+    -1,
+    methods,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr
+};
+
+}
+
+PyMODINIT_FUNC PyInit_starkiller_cxx ()
+{
+    PyObject* m = PyModule_Create(&module);
+    if (m == nullptr) {
+        return nullptr;
+    }
+
+    PyModule_AddIntConstant(m, "NumSpec", NumSpec);
+    PyModule_AddIntConstant(m, "NumAux", NumAux);
+
+    return m;
+}
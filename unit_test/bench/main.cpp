@@ -0,0 +1,100 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <AMReX_ParmParse.H>
+#include <AMReX_buildInfo.H>
+using namespace amrex;
+
+#include <extern_parameters.H>
+#include <eos.H>
+#include <network.H>
+#include <bench.H>
+#include <bench_eos.H>
+#include <bench_network.H>
+#include <bench_linear_algebra.H>
+#include <bench_esum.H>
+#ifdef CONDUCTIVITY
+#include <conductivity.H>
+#include <bench_conductivity.H>
+#endif
+#include <bench_F.H>
+
+int main(int argc, char *argv[]) {
+
+  amrex::Initialize(argc, argv);
+
+  ParmParse ppa("amr");
+
+  std::string probin_file = "probin";
+
+  ppa.query("probin_file", probin_file);
+
+  const int probin_file_length = probin_file.length();
+  Vector<int> probin_file_name(probin_file_length);
+
+  for (int i = 0; i < probin_file_length; i++)
+    probin_file_name[i] = probin_file[i];
+
+  init_unit_test(probin_file_name.dataPtr(), &probin_file_length);
+
+  // Copy extern parameters from Fortran to C++
+  init_extern_parameters();
+
+  // C++ EOS initialization (must be done after Fortran eos_init and init_extern_parameters)
+  eos_init(small_temp, small_dens);
+
+  // C++ Network, RHS, screening, rates initialization
+  network_init();
+
+#ifdef CONDUCTIVITY
+  conductivity_init();
+#endif
+
+  // report what we are benchmarking
+  for (int i = 1; i <= buildInfoGetNumModules(); i++) {
+    std::cout << buildInfoGetModuleName(i) << " = " << buildInfoGetModuleVal(i) << std::endl;
+  }
+
+  std::cout << "inputs: " << bench_nstates << " states, "
+            << bench_nwarmup << " warmup sweeps, "
+            << bench_nrep << " timed sweeps, seed " << bench_seed << std::endl;
+
+  const std::vector<eos_t> states = bench_make_states();
+
+  bench_eos(states);
+
+  bench_eos_box(states);
+
+#ifdef EOS_HELMHOLTZ
+  bench_eos_coulomb(states);
+#endif
+
+#ifdef APROX_RATES
+  bench_rates(states);
+#endif
+
+#if NUMSCREEN > 0
+  bench_screening(states);
+#endif
+
+#ifdef NEUTRINOS
+  bench_neutrinos(states);
+#endif
+
+#ifdef NETWORK_HAS_CXX_IMPLEMENTATION
+  bench_network(states);
+
+  bench_linear_algebra(states);
+#endif
+
+#ifdef CONDUCTIVITY
+  bench_conductivity(states);
+#endif
+
+  bench_esum_kernels();
+
+  std::cout << std::endl << "checksum = " << std::setprecision(16) << bench_checksum() << std::endl;
+
+  amrex::Finalize();
+}
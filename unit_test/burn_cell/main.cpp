@@ -11,6 +11,7 @@ using namespace amrex;
 #include <eos.H>
 #include <network.H>
 #include <burn_cell.H>
+#include <burn_cell_batch.H>
 #endif
 
 #include <burn_cell_F.H>
@@ -62,7 +63,12 @@ int main(int argc, char *argv[]) {
 
   if (do_cxx) {
 #ifdef CXX_REACTIONS
-      burn_cell_c();
+      if (batch_file.empty()) {
+          burn_cell_c();
+      }
+      else {
+          burn_cell_batch_c();
+      }
 #endif
   }
   else {
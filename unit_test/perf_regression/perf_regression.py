@@ -0,0 +1,325 @@
+#!/usr/bin/env python3
+
+"""Performance regression harness for the test_react and test_eos
+unit tests.
+
+We build and run a fixed matrix of cases, each one a unit test built
+with a given network, integrator, and EOS and run at a given n_cell
+and number of OpenMP threads.  The matrix is read from a JSON file
+(matrix.json in this directory by default).  Each case is run --nrep
+times, and we record the median and the median absolute deviation of
+the run time, the RHS and Jacobian evaluation counts, and, for builds
+with USE_MICROPHYSICS_PROFILE=TRUE (--profile), the time spent in each
+phase of the burn.
+
+To record a baseline:
+
+  ./perf_regression.py --record baseline.json
+
+To compare against it later (e.g. after updating Microphysics or
+AMReX):
+
+  ./perf_regression.py --compare baseline.json
+
+A timing is flagged as a regression if its median grew by more than
+--threshold (a fraction) and by more than --nsigma times the larger
+of the two median absolute deviations, so noisy cases need a larger
+change to be flagged.  A change in the number of RHS or Jacobian
+evaluations means the burner is doing different work, and is always
+reported.  The exit status is 1 if anything regressed.
+
+Each build starts from a clean tree, so this is slow; use --cases to
+run a subset of the matrix.
+"""
+
+import argparse
+import datetime
+import glob
+import json
+import os
+import platform
+import re
+import shutil
+import statistics
+import subprocess
+import sys
+
+# time out for a build or run, in seconds
+TIMEOUT = 3600
+
+# version of the baseline file format
+BASELINE_VERSION = 1
+
+UNIT_TEST_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+MICROPHYSICS_HOME = os.path.dirname(UNIT_TEST_DIR)
+
+
+def run(command, cwd=None, env=None):
+    """ run a command in the unix shell and return its output and status """
+
+    p0 = subprocess.Popen(command, stdout=subprocess.PIPE,
+                          stderr=subprocess.STDOUT, shell=True,
+                          cwd=cwd, env=env)
+
+    stdout0 = p0.communicate(timeout=TIMEOUT)
+    rc = p0.returncode
+    p0.stdout.close()
+
+    return stdout0[0].decode("utf-8"), rc
+
+
+def case_name(case):
+    """ a unique name for a case in the matrix """
+
+    return "{}.{}.{}.{}.n{}.t{}".format(case["test"], case["network"],
+                                        case.get("integrator", "none"),
+                                        case["eos"], case["n_cell"],
+                                        case["threads"])
+
+
+def build_key(case):
+    """ cases that differ only in n_cell or threads share a build """
+
+    return (case["test"], case["network"], case.get("integrator", ""), case["eos"])
+
+
+def build(case, make_args, profile):
+    """ build the unit test for a case and return the path to a copy
+        of the executable """
+
+    test_dir = os.path.join(UNIT_TEST_DIR, "test_" + case["test"])
+
+    run("make realclean", cwd=test_dir)
+
+    command = "make {} USE_OMP=TRUE NETWORK_DIR={} EOS_DIR={}".format(
+        make_args, case["network"], case["eos"])
+    if "integrator" in case:
+        command += " INTEGRATOR_DIR={}".format(case["integrator"])
+    if profile and case["test"] == "react":
+        command += " USE_MICROPHYSICS_PROFILE=TRUE"
+
+    stdout, rc = run(command, cwd=test_dir)
+
+    if rc != 0:
+        print(stdout)
+        sys.exit("ERROR: build failed for {}".format(case_name(case)))
+
+    exes = sorted(glob.glob(os.path.join(test_dir, "main*.ex")), key=os.path.getmtime)
+    if not exes:
+        sys.exit("ERROR: could not find the executable for {}".format(case_name(case)))
+
+    exe = "{}.{}".format(exes[-1], "_".join(build_key(case)))
+    shutil.copy(exes[-1], exe)
+
+    return exe
+
+
+def parse_output(stdout):
+    """ get the run time and the evaluation counts from the unit test output """
+
+    results = {}
+
+    for line in stdout.splitlines():
+        m = re.match(r"\s*Run time\s*=\s*(\S+)", line)
+        if m:
+            results["run_time"] = float(m.group(1))
+        m = re.match(r"\s*(min|avg|max) number of (rhs|jac) calls:\s*(\S+)", line)
+        if m:
+            results["{}_{}".format(m.group(1), m.group(2))] = int(m.group(3))
+
+    return results
+
+
+def run_case(case, exe, nrep):
+    """ run a case nrep times and summarize the results """
+
+    test_dir = os.path.join(UNIT_TEST_DIR, "test_" + case["test"])
+
+    env = dict(os.environ)
+    env["OMP_NUM_THREADS"] = str(case["threads"])
+
+    prefix = "perf_{}.".format(case_name(case))
+
+    command = "{} {} n_cell={}".format(exe, case["inputs"], case["n_cell"])
+    if case["test"] == "react":
+        command += " do_cxx=1 prefix={}".format(prefix)
+    else:
+        command += " do_cxx=1"
+
+    run_times = []
+    phase_times = {}
+    counts = {}
+
+    for _ in range(nrep):
+
+        stdout, rc = run(command, cwd=test_dir, env=env)
+        if rc != 0:
+            print(stdout)
+            sys.exit("ERROR: {} failed".format(case_name(case)))
+
+        results = parse_output(stdout)
+        if "run_time" not in results:
+            print(stdout)
+            sys.exit("ERROR: could not find the run time for {}".format(case_name(case)))
+
+        run_times.append(results.pop("run_time"))
+        counts = results
+
+        for profile in glob.glob(os.path.join(test_dir, prefix + "*.profile.json")):
+            with open(profile, "r") as f:
+                data = json.load(f)
+            for phase, values in data["total"]["phases"].items():
+                phase_times.setdefault(phase, []).append(values["seconds"])
+            os.remove(profile)
+
+    summary = {"case": case,
+               "run_time": summarize(run_times),
+               "counts": counts,
+               "phases": {phase: summarize(t) for phase, t in phase_times.items()}}
+
+    return summary
+
+
+def summarize(values):
+    """ the median and median absolute deviation of a list of timings """
+
+    median = statistics.median(values)
+    mad = statistics.median([abs(v - median) for v in values])
+
+    return {"median": median, "mad": mad, "samples": values}
+
+
+def is_regression(old, new, threshold, nsigma):
+    """ decide whether the timing new is significantly slower than old """
+
+    change = new["median"] - old["median"]
+    noise = max(old["mad"], new["mad"])
+
+    return change > threshold * old["median"] and change > nsigma * noise
+
+
+def get_version():
+    """ describe the Microphysics source we are testing """
+
+    stdout, rc = run("git describe --always --dirty", cwd=MICROPHYSICS_HOME)
+    return stdout.strip() if rc == 0 else "unknown"
+
+
+def doit():
+
+    parser = argparse.ArgumentParser()
+    group = parser.add_mutually_exclusive_group(required=True)
+    group.add_argument("--record", metavar="BASELINE",
+                       help="run the matrix and write the results to this baseline file")
+    group.add_argument("--compare", metavar="BASELINE",
+                       help="run the matrix and compare the results to this baseline file")
+    parser.add_argument("--matrix", default=os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                                                         "matrix.json"),
+                        help="JSON file describing the cases to run")
+    parser.add_argument("--cases", nargs="*", default=None,
+                        help="only run the cases whose names contain one of these strings")
+    parser.add_argument("--nrep", type=int, default=5,
+                        help="number of times to run each case")
+    parser.add_argument("--threshold", type=float, default=0.05,
+                        help="smallest relative slowdown that counts as a regression")
+    parser.add_argument("--nsigma", type=float, default=3.0,
+                        help="a slowdown must also exceed this many median absolute deviations")
+    parser.add_argument("--profile", action="store_true",
+                        help="build test_react with USE_MICROPHYSICS_PROFILE=TRUE to record phase timings")
+    parser.add_argument("--make_args", default="-j4",
+                        help="additional arguments to pass to make")
+
+    args = parser.parse_args()
+
+    with open(args.matrix, "r") as f:
+        matrix = json.load(f)["cases"]
+
+    if args.cases:
+        matrix = [c for c in matrix if any(s in case_name(c) for s in args.cases)]
+
+    if args.compare:
+        with open(args.compare, "r") as f:
+            baseline = json.load(f)
+        if baseline.get("version") != BASELINE_VERSION:
+            sys.exit("ERROR: {} has baseline version {}, expected {}".format(
+                args.compare, baseline.get("version"), BASELINE_VERSION))
+
+    # run the cases, building each executable once
+
+    exes = {}
+    results = {}
+
+    for case in matrix:
+        key = build_key(case)
+        if key not in exes:
+            print("building {} ...".format(" ".join(key)))
+            exes[key] = build(case, args.make_args, args.profile)
+
+        print("running {} ...".format(case_name(case)))
+        results[case_name(case)] = run_case(case, exes[key], args.nrep)
+
+    if args.record:
+
+        output = {"version": BASELINE_VERSION,
+                  "microphysics": get_version(),
+                  "host": platform.node(),
+                  "date": datetime.datetime.now().isoformat(timespec="seconds"),
+                  "nrep": args.nrep,
+                  "profile": args.profile,
+                  "results": results}
+
+        with open(args.record, "w") as f:
+            json.dump(output, f, indent=2)
+
+        print("wrote {}".format(args.record))
+        return
+
+    # compare to the baseline
+
+    print("")
+    print("comparing {} to baseline {} ({}, {})".format(
+        get_version(), args.compare, baseline["microphysics"], baseline["date"]))
+    print("")
+    print("{:50} {:>12} {:>12} {:>9}  {}".format("case", "baseline", "current", "change", "status"))
+
+    failed = False
+
+    for name, new in results.items():
+
+        if name not in baseline["results"]:
+            print("{:50} {:>12} {:12.6g} {:>9}  not in baseline".format(
+                name, "-", new["run_time"]["median"], "-"))
+            continue
+
+        old = baseline["results"][name]
+
+        timings = [("", old["run_time"], new["run_time"])]
+        for phase in sorted(new["phases"]):
+            if phase in old["phases"]:
+                timings.append(("  " + phase, old["phases"][phase], new["phases"][phase]))
+
+        for label, t_old, t_new in timings:
+            status = "ok"
+            if is_regression(t_old, t_new, args.threshold, args.nsigma):
+                status = "REGRESSION"
+                failed = True
+            elif is_regression(t_new, t_old, args.threshold, args.nsigma):
+                status = "faster"
+
+            change = (t_new["median"] - t_old["median"]) / t_old["median"] if t_old["median"] > 0 else 0.0
+
+            print("{:50} {:12.6g} {:12.6g} {:+8.1%}  {}".format(
+                name + label if label == "" else label, t_old["median"], t_new["median"], change, status))
+
+        for count in sorted(new["counts"]):
+            if count in old["counts"] and new["counts"][count] != old["counts"][count]:
+                print("{:50} {:12d} {:12d} {:>9}  CHANGED".format(
+                    "  " + count, old["counts"][count], new["counts"][count], ""))
+                failed = True
+
+    if failed:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    doit()
@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <AMReX_ParmParse.H>
+#include <AMReX_ParallelDescriptor.H>
+using namespace amrex;
+
+#include <extern_parameters.H>
+#include <eos.H>
+#include <network.H>
+#include <burner.H>
+#include <burn_trace.H>
+#include <replay_burns_F.H>
+
+// Re-burn the states in one or more traces written by the burn
+// capture (USE_BURN_CAPTURE=TRUE), report the cost, and, if the
+// trace recorded the outcome, compare to the original burns.
+
+int main(int argc, char *argv[]) {
+
+  amrex::Initialize(argc, argv);
+  {
+    ParmParse pp;
+
+    std::vector<std::string> trace_files;
+    pp.getarr("trace_files", trace_files);
+
+    std::string output_file;
+    pp.query("output_file", output_file);
+
+    ParmParse ppa("amr");
+
+    std::string probin_file = "probin";
+
+    ppa.query("probin_file", probin_file);
+
+    const int probin_file_length = probin_file.length();
+    Vector<int> probin_file_name(probin_file_length);
+
+    for (int i = 0; i < probin_file_length; i++)
+      probin_file_name[i] = probin_file[i];
+
+    init_unit_test(probin_file_name.dataPtr(), &probin_file_length);
+
+    // Copy extern parameters from Fortran to C++
+    init_extern_parameters();
+
+    // C++ EOS initialization (must be done after Fortran eos_init and init_extern_parameters)
+    eos_init(small_temp, small_dens);
+
+    // C++ Network, RHS, screening, rates initialization
+    network_init();
+
+    // read in all of the burns
+
+    std::vector<burn_trace::record_t> records;
+    bool has_outcome = true;
+
+    for (const auto& trace_file : trace_files) {
+      burn_trace::reader_t reader(trace_file);
+      has_outcome = has_outcome && reader.has_outcome();
+
+      burn_trace::record_t record;
+      while (reader.read(record)) {
+        records.push_back(record);
+      }
+    }
+
+    const int nburns = records.size();
+
+    std::cout << "read " << nburns << " burns" << std::endl;
+
+    // re-burn them
+
+    std::vector<burn_t> results(nburns);
+
+    Real strt_time = ParallelDescriptor::second();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int n = 0; n < nburns; ++n) {
+      burn_t state = records[n].state_in;
+      burner(state, records[n].dt);
+      results[n] = state;
+    }
+
+    Real stop_time = ParallelDescriptor::second() - strt_time;
+
+    // summarize
+
+    long n_rhs_sum = 0;
+    long n_jac_sum = 0;
+    int n_rhs_max = 0;
+    int num_failed = 0;
+
+    long n_rhs_sum_orig = 0;
+    long n_jac_sum_orig = 0;
+    int num_failed_orig = 0;
+    int num_n_rhs_changed = 0;
+    Real max_enuc_rel_diff = 0.0_rt;
+    Real max_X_diff = 0.0_rt;
+
+    std::ofstream of;
+    if (!output_file.empty()) {
+      of.open(output_file);
+      of << "index,rho,T,dt,success,n_rhs,n_jac";
+      if (has_outcome) {
+        of << ",success_orig,n_rhs_orig,n_jac_orig,enuc_rel_diff";
+      }
+      of << std::endl;
+    }
+
+    for (int n = 0; n < nburns; ++n) {
+
+      const burn_t& in = records[n].state_in;
+      const burn_t& out = results[n];
+
+      n_rhs_sum += out.n_rhs;
+      n_jac_sum += out.n_jac;
+      n_rhs_max = std::max(n_rhs_max, out.n_rhs);
+      if (!out.success) {
+        num_failed++;
+      }
+
+      if (of.is_open()) {
+        of << n << "," << in.rho << "," << in.T << "," << records[n].dt << ","
+           << out.success << "," << out.n_rhs << "," << out.n_jac;
+      }
+
+      if (has_outcome) {
+
+        const burn_t& orig = records[n].state_out;
+
+        n_rhs_sum_orig += orig.n_rhs;
+        n_jac_sum_orig += orig.n_jac;
+        if (!orig.success) {
+          num_failed_orig++;
+        }
+        if (orig.n_rhs != out.n_rhs) {
+          num_n_rhs_changed++;
+        }
+
+        // the energy released, relative to the original
+        Real enuc_rel_diff = std::abs(out.e - orig.e) / amrex::max(std::abs(orig.e), 1.e-30_rt);
+        max_enuc_rel_diff = amrex::max(max_enuc_rel_diff, enuc_rel_diff);
+
+        for (int i = 0; i < NumSpec; ++i) {
+          max_X_diff = amrex::max(max_X_diff, std::abs(out.xn[i] - orig.xn[i]));
+        }
+
+        if (of.is_open()) {
+          of << "," << orig.success << "," << orig.n_rhs << "," << orig.n_jac << "," << enuc_rel_diff;
+        }
+      }
+
+      if (of.is_open()) {
+        of << std::endl;
+      }
+    }
+
+    std::cout << "Run time = " << stop_time << std::endl;
+    std::cout << "number of failed burns: " << num_failed << std::endl;
+    std::cout << "total number of rhs calls: " << n_rhs_sum << std::endl;
+    std::cout << "total number of jac calls: " << n_jac_sum << std::endl;
+    std::cout << "max number of rhs calls: " << n_rhs_max << std::endl;
+
+    if (has_outcome) {
+      std::cout << std::endl << "original burns:" << std::endl;
+      std::cout << "number of failed burns: " << num_failed_orig << std::endl;
+      std::cout << "total number of rhs calls: " << n_rhs_sum_orig << std::endl;
+      std::cout << "total number of jac calls: " << n_jac_sum_orig << std::endl;
+      std::cout << "burns with a different number of rhs calls: " << num_n_rhs_changed << std::endl;
+      std::cout << "max relative difference in energy release: " << max_enuc_rel_diff << std::endl;
+      std::cout << "max difference in mass fractions: " << max_X_diff << std::endl;
+    }
+  }
+  amrex::Finalize();
+}
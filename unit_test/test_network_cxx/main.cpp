@@ -0,0 +1,49 @@
+#include <iostream>
+#include <string>
+
+#include <AMReX_ParmParse.H>
+using namespace amrex;
+
+#include <extern_parameters.H>
+#include <eos.H>
+#include <network.H>
+#include <test_network_cxx.H>
+#include <test_network_cxx_F.H>
+
+int main(int argc, char *argv[]) {
+
+  amrex::Initialize(argc, argv);
+
+  ParmParse ppa("amr");
+
+  std::string probin_file = "probin";
+
+  ppa.query("probin_file", probin_file);
+
+  const int probin_file_length = probin_file.length();
+  Vector<int> probin_file_name(probin_file_length);
+
+  for (int i = 0; i < probin_file_length; i++)
+    probin_file_name[i] = probin_file[i];
+
+  init_unit_test(probin_file_name.dataPtr(), &probin_file_length);
+
+  // Copy extern parameters from Fortran to C++
+  init_extern_parameters();
+
+  // C++ EOS initialization (must be done after Fortran eos_init and init_extern_parameters)
+  eos_init(small_temp, small_dens);
+
+  // C++ Network, RHS, screening, rates initialization
+  network_init();
+
+  int n_failed = test_network_cxx_c();
+
+  if (n_failed > 0) {
+      amrex::Abort("test_network_cxx failed");
+  }
+
+  std::cout << "test_network_cxx passed" << std::endl;
+
+  amrex::Finalize();
+}
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+
+"""Accuracy regression test for the mixed precision VODE linear algebra.
+
+For each test_react inputs file given on the commandline, we run the
+executable twice: once with the default double precision LU
+factorization and once with use_mixed_precision_lu = T.  The two
+plotfiles are then compared with the AMReX fcompare tool and we
+report the largest relative error over all of the plotfile variables,
+along with the average number of RHS evaluations for each run.
+
+Example:
+
+  ./compare_mixed_precision.py --exe main3d.gnu.ex \\
+      --fcompare $AMREX_HOME/Tools/Plotfile/fcompare.gnu.ex \\
+      inputs_aprox13 inputs_aprox19 inputs_aprox21
+
+The C++ burner must be used (do_cxx = 1), since the mixed precision
+option is only implemented in the C++ VODE.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+# time out for a run, in seconds
+TIMEOUT = 600
+
+
+def run(command):
+    """ run a command in the unix shell and return its output and status """
+
+    p0 = subprocess.Popen(command, stdout=subprocess.PIPE,
+                          stderr=subprocess.STDOUT, shell=True)
+
+    stdout0 = p0.communicate(timeout=TIMEOUT)
+    rc = p0.returncode
+    p0.stdout.close()
+
+    return stdout0[0].decode("utf-8"), rc
+
+
+def get_probin_file(inputs_file):
+    """ find the probin file referenced in a test_react inputs file """
+
+    probin = "probin"
+    with open(inputs_file, "r") as f:
+        for line in f:
+            m = re.match(r"\s*amr.probin_file\s*=\s*(\S+)", line)
+            if m:
+                probin = m.group(1)
+    return probin
+
+
+def write_probin(probin_in, probin_out, params):
+    """ copy a probin file, adding params to the &extern namelist """
+
+    with open(probin_in, "r") as fin, open(probin_out, "w") as fout:
+        in_extern = False
+        for line in fin:
+            if line.strip().lower().startswith("&extern"):
+                in_extern = True
+            elif in_extern and line.strip() == "/":
+                for k, v in params.items():
+                    fout.write("  {} = {}\n".format(k, v))
+                in_extern = False
+            fout.write(line)
+
+
+def get_avg_nrhs(stdout):
+    """ parse the average number of RHS calls from the test_react output """
+
+    for line in stdout.splitlines():
+        if line.startswith("avg number of rhs calls"):
+            return int(line.split(":")[-1])
+    return -1
+
+
+def get_max_rel_error(stdout):
+    """ parse the largest relative error from the fcompare output """
+
+    max_err = 0.0
+    for line in stdout.splitlines():
+        fields = line.split()
+        if len(fields) != 3:
+            continue
+        try:
+            err = float(fields[2].replace("D", "e"))
+        except ValueError:
+            continue
+        max_err = max(max_err, err)
+    return max_err
+
+
+def doit():
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--exe", required=True,
+                        help="test_react executable")
+    parser.add_argument("--fcompare", required=True,
+                        help="AMReX fcompare executable")
+    parser.add_argument("--rel_tol", type=float, default=1.e-6,
+                        help="maximum allowed relative difference between the runs")
+    parser.add_argument("--refinement_steps", type=int, default=1,
+                        help="number of iterative refinement steps to use")
+    parser.add_argument("inputs", nargs="+",
+                        help="test_react inputs files to run")
+
+    args = parser.parse_args()
+
+    failed = []
+
+    for inputs in args.inputs:
+
+        probin = get_probin_file(inputs)
+
+        outcomes = {}
+
+        for mode, value in [("double", "F"), ("mixed", "T")]:
+
+            probin_mode = "{}.{}".format(probin, mode)
+            write_probin(probin, probin_mode,
+                         {"use_mixed_precision_lu": value,
+                          "vode_lu_refinement_steps": args.refinement_steps})
+
+            prefix = "{}.{}.".format(inputs, mode)
+            command = "{} {} do_cxx=1 amr.probin_file={} prefix={}".format(
+                args.exe, inputs, probin_mode, prefix)
+
+            print("running {} with {} precision LU ...".format(inputs, mode))
+            stdout, rc = run(command)
+
+            if rc != 0:
+                sys.exit("ERROR: {} failed with {} precision LU".format(inputs, mode))
+
+            plotfiles = [d for d in os.listdir(".")
+                         if d.startswith(prefix + "test_react") and os.path.isdir(d)]
+
+            outcomes[mode] = (plotfiles[0], get_avg_nrhs(stdout))
+
+        stdout, rc = run("{} {} {}".format(args.fcompare,
+                                           outcomes["double"][0],
+                                           outcomes["mixed"][0]))
+
+        err = get_max_rel_error(stdout)
+
+        status = "passed" if err <= args.rel_tol else "FAILED"
+        if err > args.rel_tol:
+            failed.append(inputs)
+
+        print("{}: {} (max relative error = {:12.6g}, avg RHS calls: double = {}, mixed = {})".format(
+            inputs, status, err, outcomes["double"][1], outcomes["mixed"][1]))
+
+    if failed:
+        sys.exit("mixed precision LU regression failed for: {}".format(" ".join(failed)))
+
+
+if __name__ == "__main__":
+    doit()
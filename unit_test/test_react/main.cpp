@@ -21,6 +21,7 @@ using namespace amrex;
 #include <variables.H>
 #include <unit_test.H>
 #include <react_util.H>
+#include <microphysics_profile.H>
 #ifdef NSE_THERMO
 #include <nse.H>
 #endif
@@ -46,6 +47,8 @@ void main_main ()
 
     int do_cxx = 0;
 
+    int write_diagnostics = 0;
+
     // inputs parameters
     {
         // ParmParse is way of reading inputs from the inputs file
@@ -66,6 +69,8 @@ void main_main ()
 
 #ifdef CXX_REACTIONS
         pp.query("do_cxx", do_cxx);
+
+        pp.query("write_diagnostics", write_diagnostics);
 #endif
 
     }
@@ -204,6 +209,16 @@ void main_main ()
     // so we can manually do the reductions (for GPU)
     iMultiFab integrator_n_rhs(ba, dm, 1, Nghost);
 
+#ifdef CXX_REACTIONS
+    // and the full set of integrator diagnostics (only filled by the C++ burner)
+    iMultiFab integrator_diag(ba, dm, burn_diagnostics::NumComponents, Nghost);
+    integrator_diag.setVal(0);
+#endif
+
+#ifdef MICROPHYSICS_PROFILE
+    microphysics_profile::reset();
+#endif
+
     // What time is it now?  We'll use this to compute total react time.
     Real strt_time = ParallelDescriptor::second();
 
@@ -224,10 +239,11 @@ void main_main ()
 
             auto s = state.array(mfi);
             auto n_rhs = integrator_n_rhs.array(mfi);
+            auto diag = integrator_diag.array(mfi);
 
             AMREX_PARALLEL_FOR_3D(bx, i, j, k,
             {
-                bool success = do_react(i, j, k, s, n_rhs, vars);
+                bool success = do_react(i, j, k, s, n_rhs, diag, vars);
 
                 if (!success) {
                     Gpu::Atomic::Add(num_failed_d, 1);
@@ -254,16 +270,26 @@ void main_main ()
     aa_num_failed.copyToHost(&num_failed, 1);
     Gpu::synchronize();
 
-    if (num_failed > 0) {
-        amrex::Abort("Integration failed");
-    }
-
     // Call the timer again and compute the maximum difference between
-    // the start time and stop time over all processors
+    // the start time and stop time over all processors, before the
+    // diagnostics, so that the run time is that of the burn alone
     Real stop_time = ParallelDescriptor::second() - strt_time;
     const int IOProc = ParallelDescriptor::IOProcessorNumber();
     ParallelDescriptor::ReduceRealMax(stop_time, IOProc);
 
+#ifdef CXX_REACTIONS
+    // Summarize the integrator diagnostics before we check for
+    // failures, so we know why any burns failed.
+    if (do_cxx) {
+        std::string diag_prefix = write_diagnostics ? prefix + "test_react.diagnostics" : "";
+        burn_diagnostics::report(integrator_diag, diag_prefix);
+    }
+#endif
+
+    if (num_failed > 0) {
+        amrex::Abort("Integration failed");
+    }
+
     int n_rhs_min = integrator_n_rhs.min(0);
     int n_rhs_max = integrator_n_rhs.max(0);
     long n_rhs_sum = integrator_n_rhs.sum(0, 0, true);
@@ -295,6 +321,11 @@ void main_main ()
 
     write_job_info(prefix + name + integrator + language);
 
+#ifdef MICROPHYSICS_PROFILE
+    // Write the breakdown of the time spent in each phase of the burn.
+    microphysics_profile::write_report(prefix + name + integrator + language + ".profile");
+#endif
+
     // Tell the I/O Processor to write out the "run time"
     amrex::Print() << "Run time = " << stop_time << std::endl;
 
@@ -303,4 +334,22 @@ void main_main ()
     std::cout << "avg number of rhs calls: " << n_rhs_sum / (n_cell*n_cell*n_cell) << std::endl;
     std::cout << "max number of rhs calls: " << n_rhs_max << std::endl;
 
+#ifdef CXX_REACTIONS
+    if (do_cxx) {
+        int n_jac_min = integrator_diag.min(burn_diagnostics::n_jac);
+        int n_jac_max = integrator_diag.max(burn_diagnostics::n_jac);
+        long n_jac_sum = integrator_diag.sum(burn_diagnostics::n_jac, 0, true);
+
+        std::cout << "min number of jac calls: " << n_jac_min << std::endl;
+        std::cout << "avg number of jac calls: " << n_jac_sum / (n_cell*n_cell*n_cell) << std::endl;
+        std::cout << "max number of jac calls: " << n_jac_max << std::endl;
+    }
+#endif
+
+#if defined(CXX_REACTIONS) && (INTEGRATOR == 0)
+    // The VODE integration state lives on the stack of each zone
+    // being burned, so report how large it is.
+    amrex::Print() << "VODE integration state (bytes per zone): " << sizeof(dvode_t) << std::endl;
+#endif
+
 }
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+
+"""Benchmark and accuracy report for the esum summation methods.
+
+esum, the summation used in the C++ network RHS, can be built with
+three methods, chosen at compile time with ESUM_METHOD:
+
+  MSUM      exact summation (the default)
+  NEUMAIER  branch-free compensated summation
+  SUM       plain sequential summation
+
+For each network given on the commandline, we build test_rhs with
+each method, run it on inputs_<network>, and compare the plotfiles
+(which contain the RHS and Jacobian) against the MSUM run with the
+AMReX fcompare tool.  We report the best run time over --nrep runs,
+the speedup relative to MSUM, and the largest relative error over
+all of the plotfile variables.
+
+Example:
+
+  ./compare_esum.py --fcompare $AMREX_HOME/Tools/Plotfile/fcompare.gnu.ex \\
+      aprox13 aprox19 iso7
+
+Each build starts from a clean tree, since changing ESUM_METHOD does
+not by itself trigger a rebuild.
+"""
+
+import argparse
+import glob
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+# time out for a build or run, in seconds
+TIMEOUT = 3600
+
+METHODS = ["MSUM", "NEUMAIER", "SUM"]
+
+
+def run(command):
+    """ run a command in the unix shell and return its output and status """
+
+    p0 = subprocess.Popen(command, stdout=subprocess.PIPE,
+                          stderr=subprocess.STDOUT, shell=True)
+
+    stdout0 = p0.communicate(timeout=TIMEOUT)
+    rc = p0.returncode
+    p0.stdout.close()
+
+    return stdout0[0].decode("utf-8"), rc
+
+
+def build(network, method, make_args):
+    """ build test_rhs for a network and summation method and return
+        the name of a copy of the executable """
+
+    run("make realclean")
+
+    stdout, rc = run("make {} NETWORK_DIR={} ESUM_METHOD={}".format(
+        make_args, network, method))
+
+    if rc != 0:
+        print(stdout)
+        sys.exit("ERROR: build failed for {} with ESUM_METHOD={}".format(network, method))
+
+    exes = sorted(glob.glob("main*.ex"), key=os.path.getmtime)
+    if not exes:
+        sys.exit("ERROR: could not find the executable")
+
+    exe = "{}.{}.{}".format(exes[-1], network, method)
+    shutil.copy(exes[-1], exe)
+
+    return exe
+
+
+def get_run_time(stdout):
+    """ parse the run time from the test_rhs output """
+
+    for line in stdout.splitlines():
+        m = re.match(r"\s*Run time\s*=\s*(\S+)", line)
+        if m:
+            return float(m.group(1))
+    return -1.0
+
+
+def get_max_rel_error(stdout):
+    """ parse the largest relative error from the fcompare output """
+
+    max_err = 0.0
+    for line in stdout.splitlines():
+        fields = line.split()
+        if len(fields) != 3:
+            continue
+        try:
+            err = float(fields[2].replace("D", "e"))
+        except ValueError:
+            continue
+        max_err = max(max_err, err)
+    return max_err
+
+
+def doit():
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--fcompare", required=True,
+                        help="AMReX fcompare executable")
+    parser.add_argument("--nrep", type=int, default=3,
+                        help="number of times to run each executable (the best time is reported)")
+    parser.add_argument("--make_args", default="-j4",
+                        help="additional arguments to pass to make")
+    parser.add_argument("networks", nargs="+",
+                        help="networks to test (each needs an inputs_<network> file)")
+
+    args = parser.parse_args()
+
+    report = []
+
+    for network in args.networks:
+
+        inputs = "inputs_{}".format(network)
+        if not os.path.isfile(inputs):
+            sys.exit("ERROR: {} does not exist".format(inputs))
+
+        outcomes = {}
+
+        for method in METHODS:
+
+            print("building {} with ESUM_METHOD={} ...".format(network, method))
+            exe = build(network, method, args.make_args)
+
+            prefix = "{}.{}.".format(network, method)
+
+            best_time = None
+            for _ in range(args.nrep):
+                stdout, rc = run("./{} {} do_cxx=1 prefix={}".format(exe, inputs, prefix))
+                if rc != 0:
+                    print(stdout)
+                    sys.exit("ERROR: {} failed with ESUM_METHOD={}".format(network, method))
+                t = get_run_time(stdout)
+                if best_time is None or t < best_time:
+                    best_time = t
+
+            plotfiles = [d for d in os.listdir(".")
+                         if d.startswith(prefix + "test_rhs") and os.path.isdir(d)]
+
+            outcomes[method] = (plotfiles[0], best_time)
+
+        for method in METHODS:
+            if method == "MSUM":
+                err = 0.0
+            else:
+                stdout, rc = run("{} {} {}".format(args.fcompare,
+                                                   outcomes["MSUM"][0],
+                                                   outcomes[method][0]))
+                err = get_max_rel_error(stdout)
+
+            t = outcomes[method][1]
+            report.append((network, method, t, outcomes["MSUM"][1] / t, err))
+
+    print("")
+    print("{:20} {:10} {:>14} {:>10} {:>20}".format(
+        "network", "method", "run time", "speedup", "max relative error"))
+    for network, method, t, speedup, err in report:
+        print("{:20} {:10} {:14.6g} {:10.3f} {:20.6g}".format(
+            network, method, t, speedup, err))
+
+
+if __name__ == "__main__":
+    doit()
@@ -0,0 +1,53 @@
+#include <iostream>
+#include <string>
+
+#include <AMReX_ParmParse.H>
+#include <AMReX_ParallelDescriptor.H>
+using namespace amrex;
+
+#include <extern_parameters.H>
+#include <eos.H>
+#include <network.H>
+#include <test_stellarcollapse.H>
+#include <test_stellarcollapse_F.H>
+
+int main(int argc, char *argv[]) {
+
+  amrex::Initialize(argc, argv);
+
+  ParmParse ppa("amr");
+
+  std::string probin_file = "probin";
+
+  ppa.query("probin_file", probin_file);
+
+  const int probin_file_length = probin_file.length();
+  Vector<int> probin_file_name(probin_file_length);
+
+  for (int i = 0; i < probin_file_length; i++)
+    probin_file_name[i] = probin_file[i];
+
+  init_unit_test(probin_file_name.dataPtr(), &probin_file_length);
+
+  // Copy extern parameters from Fortran to C++
+  init_extern_parameters();
+
+  // write the synthetic table that the EOS reads
+  if (ParallelDescriptor::IOProcessor()) {
+      test_stellarcollapse_write_table(eos_file);
+  }
+  ParallelDescriptor::Barrier();
+
+  // C++ EOS initialization (must be done after init_extern_parameters)
+  eos_init(small_temp, small_dens);
+
+  int n_failed = test_stellarcollapse_c();
+
+  if (n_failed > 0) {
+      amrex::Abort("test_stellarcollapse failed");
+  }
+
+  std::cout << "test_stellarcollapse passed" << std::endl;
+
+  amrex::Finalize();
+}
@@ -29,9 +29,27 @@ module_start = """
 // mean that the result is the same).
 
 // This routine is called "esum" for generality
-// because in principle we could add implementations
-// other than msum that do exact arithmetic, without
-// changing the interface as seen in the networks.
+// because it can be implemented by methods other
+// than msum without changing the interface as seen
+// in the networks. The method is chosen at compile
+// time with the ESUM_METHOD make variable:
+//
+// MSUM     (default): exact summation with msum
+// NEUMAIER: branch-free compensated summation
+// SUM:      plain sequential summation
+//
+// which sets ESUM_NEUMAIER or ESUM_SUM for the
+// non-default methods.
+
+// NEUMAIER is compensated summation: each addition is
+// done with Knuth's TwoSum, which recovers the rounding
+// error of the addition without any branches, and the
+// errors are accumulated and added back at the end.
+// This is equivalent to Neumaier's improved Kahan
+// summation and gives a result as accurate as if it
+// were computed in twice the working precision, though
+// unlike msum it is not exact. As with msum, this relies
+// on the compiler not reassociating the operations.
 
 #ifndef _esum_H_
 #define _esum_H_
@@ -104,15 +122,16 @@ sum_template = """
 
 
 
-kahan_template = """
+neumaier_template = """
     esum = array(1);
-    Real x = 0._rt;
+    Real c = 0.0_rt;
     for (int i = 2; i <= @NUM@; ++i) {
-       Real y = array(i) - x;
-       Real z = esum + y;
-       x = (z - esum) - y;
-       esum = z;
+       Real t = esum + array(i);
+       Real z = t - esum;
+       c += (esum - (t - z)) + (array(i) - z);
+       esum = t;
     }
+    esum += c;
 """
 
 
@@ -201,18 +220,13 @@ msum_template = """
 
 if __name__ == "__main__":
 
-    sum_method = 0
     unroll = True
 
     parser = argparse.ArgumentParser()
-    parser.add_argument('-s', help='summation method: -1 == sum(); 0 == msum; 1 == Kahan')
     parser.add_argument('--unroll', help='For msum, should we explicitly unroll the loop?')
 
     args = parser.parse_args()
 
-    if args.s != None:
-        sum_method = int(args.s)
-
     if args.unroll != None:
         if args.unroll == "True":
             unroll = True
@@ -232,52 +246,48 @@ if __name__ == "__main__":
 
             ef.write(esum_template_start.replace("@NUM@", str(num)))
 
-            if sum_method == -1:
-
-                # ArrayUtil::Math::sum is just a sequential loop
+            # ArrayUtil::Math::sum is just a sequential loop
 
-                ef.write(sum_template.replace("@NUM@", str(num)))
+            ef.write("\n#if defined(ESUM_SUM)\n")
 
-            elif sum_method == 0:
+            ef.write(sum_template.replace("@NUM@", str(num)))
 
-                # msum
+            ef.write("\n#elif defined(ESUM_NEUMAIER)\n")
 
-                if unroll:
+            ef.write(neumaier_template.replace("@NUM@", str(num)))
 
-                    ef.write(msum_template_start.replace("@NUM@", str(num)).replace("@NUMPARTIALS@", str(4)))
-
-                    i = 1
-                    while (i < num):
-                        if (i == num - 3):
-                            if (i > 0):
-                                offset = i-1
-                            else:
-                                offset = 0
-                            ef.write(msum_template.replace("@START@", str(offset)).replace("@NUM@", str(4)))
-                            break
-                        else:
-                            if (i > 0):
-                                offset = i-1
-                            else:
-                                offset = 0
-                            ef.write(msum_template.replace("@START@", str(offset)).replace("@NUM@", str(3)))
-                            i += 2
+            ef.write("\n#else\n")
 
-                else:
+            # msum
 
-                    ef.write(msum_template_start.replace("@NUM@", str(num)).replace("@NUMPARTIALS@", str(num-1)))
+            if unroll:
 
-                    ef.write(msum_template.replace("@START@", str(0)).replace("@NUM@", str(num)))
+                ef.write(msum_template_start.replace("@NUM@", str(num)).replace("@NUMPARTIALS@", str(4)))
 
-            elif sum_method == 1:
+                i = 1
+                while (i < num):
+                    if (i == num - 3):
+                        if (i > 0):
+                            offset = i-1
+                        else:
+                            offset = 0
+                        ef.write(msum_template.replace("@START@", str(offset)).replace("@NUM@", str(4)))
+                        break
+                    else:
+                        if (i > 0):
+                            offset = i-1
+                        else:
+                            offset = 0
+                        ef.write(msum_template.replace("@START@", str(offset)).replace("@NUM@", str(3)))
+                        i += 2
 
-                # Kahan
+            else:
 
-                ef.write(kahan_template.replace("@NUM@", str(num)))
+                ef.write(msum_template_start.replace("@NUM@", str(num)).replace("@NUMPARTIALS@", str(num-1)))
 
-            else:
+                ef.write(msum_template.replace("@START@", str(0)).replace("@NUM@", str(num)))
 
-                raise ValueError("Unknown summation method.")
+            ef.write("\n#endif\n")
 
             ef.write(esum_template_end.replace("@NUM@", str(num)))
             ef.write("\n")